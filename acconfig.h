@@ -42,5 +42,7 @@
 #define THREADS_NONE 0
 #define THREADS_POSIX 0
 
+#undef HAVE_STAT_ST_MTIM
+
 /*@BOTTOM@*/
 #endif /* _config_h_ */
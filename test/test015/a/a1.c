@@ -0,0 +1,2 @@
+#include "a/x.h"
+int a1;
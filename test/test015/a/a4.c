@@ -0,0 +1,2 @@
+#include "a/y.h"
+int a4;
@@ -0,0 +1 @@
+int d3;